@@ -196,6 +196,12 @@
 // code because future Rabbit devices may use an OUI other than 00:90:C2.
 //#define DHCPD_RABBIT_ONLY
 
+// Uncomment the following macro definition to save the DHCP leases table in
+// the userblock, so that clients keep their IP addresses across a reset of
+// this DHCP server.  Check your board's manual first, to make sure that this
+// offset does not overwrite calibration constants stored in the userblock.
+//#define DHCPD_USERBLOCK_OFFSET       0
+
 // Uncomment the following macro definition to see DHCP server library activity,
 // progress and status information (output to STDIO).
 //#define DHCPD_VERBOSE
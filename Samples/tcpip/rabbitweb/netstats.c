@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2015, Digi International Inc.
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+   ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+   ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+/*******************************************************************************
+        Samples\TcpIp\RabbitWeb\netstats.c
+
+        Demonstrates the TCP/IP stack packet counters (net_stats).  The
+        counters are registered with RabbitWeb and sent to the browser
+        as a single JSON object, which the page refreshes every few
+        seconds.
+
+        The same counters are available to the application directly,
+        via ifconfig(IFG_STATS) for a single interface, or via SNMP by
+        calling snmp_add_netstats().
+
+        See:
+        samples\tcpip\rabbitweb\pages\netstats.zhtml
+
+*******************************************************************************/
+
+/***********************************
+ * Configuration                   *
+ * -------------                   *
+ * All fields in this section must *
+ * be altered to match your local  *
+ * network settings.               *
+ ***********************************/
+
+/*
+ * NETWORK CONFIGURATION
+ * Please see the function help (Ctrl-H) on TCPCONFIG for instructions on
+ * compile-time network configuration.
+ */
+#define TCPCONFIG 1
+
+/********************************
+ * End of configuration section *
+ ********************************/
+
+/*
+ * Maintain the packet counters in net_stats.
+ */
+#define NET_STATS
+
+/*
+ * This is needed to be able to use the RabbitWeb HTTP enhancements and the
+ * ZHTML scripting language.
+ */
+#define USE_RABBITWEB 1
+
+#memmap xmem
+
+#use "dcrtcp.lib"
+#use "http.lib"
+
+#ximport "samples/tcpip/rabbitweb/pages/netstats.zhtml"	netstats_zhtml
+
+/* The default mime type for '/' must be first */
+SSPEC_MIMETABLE_START
+   // This handler enables the ZHTML parser to be used on ZHTML files...
+	SSPEC_MIME_FUNC(".zhtml", "text/html", zhtml_handler),
+	SSPEC_MIME(".html", "text/html")
+SSPEC_MIMETABLE_END
+
+/* Associate the #ximported files with the web server */
+SSPEC_RESOURCETABLE_START
+	SSPEC_RESOURCE_XMEMFILE("/", netstats_zhtml),
+	SSPEC_RESOURCE_XMEMFILE("/index.zhtml", netstats_zhtml)
+SSPEC_RESOURCETABLE_END
+
+/*
+ * #web statements.  The counters are maintained by the stack, so the
+ * browser may only read them.
+ */
+#web net_stats groups=all(ro)
+
+void main(void)
+{
+	// Initialize the TCP/IP stack and HTTP server
+	// Start network and wait for interface to come up (or error exit).
+	sock_init_or_exit(1);
+   http_init();
+
+	// This yields a performance improvement for an HTTP server
+	tcp_reserveport(80);
+
+   while (1) {
+		// Drive the HTTP server
+      http_handler();
+   }
+}